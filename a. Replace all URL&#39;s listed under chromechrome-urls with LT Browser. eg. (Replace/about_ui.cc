@@ -26,6 +26,7 @@
 #include "base/memory/singleton.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/process/process_metrics.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
@@ -37,6 +38,7 @@
 #include "base/task/thread_pool.h"
 #include "base/threading/scoped_blocking_call.h"
 #include "base/threading/thread.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "build/build_config.h"
 #include "build/chromeos_buildflags.h"
@@ -83,7 +85,6 @@
 
 #include "base/base64.h"
 #include "base/stl_util.h"
-#include "base/strings/strcat.h"
 #include "chrome/browser/ash/customization/customization_document.h"
 #include "chrome/browser/ash/login/demo_mode/demo_setup_controller.h"
 #include "chrome/browser/ash/login/wizard_controller.h"
@@ -234,6 +235,7 @@ class ChromeOSTermsHandler
   }
 
   void LoadOemEulaFileAsync() {
+    TRACE_EVENT0("browser", "ChromeOSTermsHandler::LoadOemEulaFileAsync");
     base::ScopedBlockingCall scoped_blocking_call(
         FROM_HERE, base::BlockingType::MAY_BLOCK);
 
@@ -252,6 +254,8 @@ class ChromeOSTermsHandler
   }
 
   void LoadArcPrivacyPolicyFileAsync() {
+    TRACE_EVENT0("browser",
+                 "ChromeOSTermsHandler::LoadArcPrivacyPolicyFileAsync");
     base::ScopedBlockingCall scoped_blocking_call(
         FROM_HERE, base::BlockingType::MAY_BLOCK);
 
@@ -274,6 +278,7 @@ class ChromeOSTermsHandler
   }
 
   void LoadArcTermsFileAsync() {
+    TRACE_EVENT0("browser", "ChromeOSTermsHandler::LoadArcTermsFileAsync");
     base::ScopedBlockingCall scoped_blocking_call(
         FROM_HERE, base::BlockingType::MAY_BLOCK);
 
@@ -379,6 +384,7 @@ class ChromeOSCreditsHandler
   }
 
   void LoadCreditsFileAsync() {
+    TRACE_EVENT0("browser", "ChromeOSCreditsHandler::LoadCreditsFileAsync");
     base::FilePath credits_file_path(chrome::kChromeOSCreditsPath);
     if (!base::ReadFileToString(credits_file_path, &contents_)) {
       // File with credits not found, ResponseOnUIThread will load credits
@@ -461,6 +467,8 @@ class CrostiniCreditsHandler
   }
 
   void LoadCrostiniCreditsFileAsync(base::FilePath credits_file_path) {
+    TRACE_EVENT0("browser",
+                 "CrostiniCreditsHandler::LoadCrostiniCreditsFileAsync");
     if (!base::ReadFileToString(credits_file_path, &contents_)) {
       // File with credits not found, ResponseOnUIThread will load a placeholder
       // if contents_ is empty.
@@ -548,26 +556,26 @@ std::string ChromeURLs() {
   AppendBody(&html);
 
   html += "<h2>List of Lt-Browser URLs</h2>\n<ul>\n";
-  std::vector<std::string> hosts(
+  std::vector<base::StringPiece> hosts(
       chrome::kChromeHostURLs,
       chrome::kChromeHostURLs + chrome::kNumberOfChromeHostURLs);
   std::sort(hosts.begin(), hosts.end());
-  for (const std::string& host : hosts) {
-    html +=
-        "<li><a href='chrome://" + host + "/'>lt-browser://" + host + "</a></li>\n";
+  for (base::StringPiece host : hosts) {
+    base::StrAppend(&html, {"<li><a href='chrome://", host, "/'>lt-browser://",
+                            host, "</a></li>\n"});
   }
 
   html +=
       "</ul><a id=\"internals\"><h2>List of lt-browser://internals "
       "pages</h2></a>\n<ul>\n";
-  std::vector<std::string> internals_paths(
+  std::vector<base::StringPiece> internals_paths(
       chrome::kChromeInternalsPathURLs,
       chrome::kChromeInternalsPathURLs +
           chrome::kNumberOfChromeInternalsPathURLs);
   std::sort(internals_paths.begin(), internals_paths.end());
-  for (const std::string& path : internals_paths) {
-    html += "<li><a href='chrome://internals/" + path +
-            "'>lt-browser://internals/" + path + "</a></li>\n";
+  for (base::StringPiece path : internals_paths) {
+    base::StrAppend(&html, {"<li><a href='chrome://internals/", path,
+                            "'>lt-browser://internals/", path, "</a></li>\n"});
   }
 
   html += "</ul>\n<h2>For Debug</h2>\n"
@@ -575,7 +583,7 @@ std::string ChromeURLs() {
       "crash or hang the renderer, they're not linked directly; you can type "
       "them into the address bar if you need them.</p>\n<ul>";
   for (size_t i = 0; i < chrome::kNumberOfChromeDebugURLs; i++)
-    html += "<li>" + std::string(chrome::kChromeDebugURLs[i]) + "</li>\n";
+    base::StrAppend(&html, {"<li>", chrome::kChromeDebugURLs[i], "</li>\n"});
   html += "</ul>\n";
 
   AppendFooter(&html);
@@ -618,6 +626,10 @@ void AboutUIHTMLSource::StartDataRequest(
     const GURL& url,
     const content::WebContents::Getter& wc_getter,
     content::URLDataSource::GotDataCallback callback) {
+  // Only covers the synchronous part of the request. Handlers that finish
+  // on the thread pool trace their own tasks.
+  TRACE_EVENT1("browser", "AboutUIHTMLSource::StartDataRequest", "source",
+               source_name_);
   // TODO(crbug/1009127): Simplify usages of |path| since |url| is available.
   const std::string path = content::URLDataSource::URLToRequestPath(url);
   std::string response;